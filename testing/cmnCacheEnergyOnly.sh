@@ -0,0 +1,30 @@
+#!/bin/sh
+# podBasisCalc -cmnCache -energyOnly on windows whose entries of Cmn are all cached must..
+# ..not read any snapshot and must reproduce the energies of the run that cached them
+#   cmnCacheEnergyOnly.sh <podBasisCalc> <prepared case> <work dir>
+set -e
+
+noSnapshotsRead()
+{
+  if grep -q "Reading fields U" "$1"
+  then
+    echo "Snapshots read although every entry of Cmn is cached ($1)"
+    exit 1
+  fi
+}
+
+rm -rf "$3"
+cp -r "$2" "$3"
+cd "$3"
+
+"$1" 0 -cmnCache -energyOnly > log.fill
+cp podEnergy.csv podEnergy.fill
+
+# a smaller window of cached snapshots
+"$1" 0 -cmnCache -energyOnly -time 0.3:1.2 > log.window
+noSnapshotsRead log.window
+
+# the whole window again
+"$1" 0 -cmnCache -energyOnly > log.cached
+noSnapshotsRead log.cached
+cmp podEnergy.csv podEnergy.fill
@@ -0,0 +1,54 @@
+"""Compares UMean of the last time directory of a case with the mean of the U snapshots of
+all time directories but 0, as podBasisCalc -computeMean selects them by default.
+
+    python compareMean.py <case>
+"""
+
+import os
+import re
+import sys
+
+
+def internal_field(path):
+    """Internal field of an ASCII volVectorField as a list of (x, y, z)"""
+    with open(path) as f:
+        text = f.read()
+
+    text = text[text.index("internalField"):]
+    vector = r"\(\s*([^\s()]+)\s+([^\s()]+)\s+([^\s()]+)\s*\)"
+
+    uniform = re.match(r"internalField\s+uniform\s+" + vector, text)
+    if uniform:
+        return [tuple(float(v) for v in uniform.groups())]
+
+    size = re.match(r"internalField\s+nonuniform\s+List<vector>\s+(\d+)\s*\(", text)
+    values = re.finditer(vector, text[size.end():])
+    return [tuple(float(v) for v in next(values).groups()) for _ in range(int(size.group(1)))]
+
+
+def main(case):
+    times = []
+    for name in os.listdir(case):
+        try:
+            if float(name) > 0:
+                times.append(name)
+        except ValueError:
+            pass
+    times.sort(key=float)
+
+    snapshots = [internal_field(os.path.join(case, t, "U")) for t in times]
+    mean = [tuple(sum(s[c][d] for s in snapshots)/len(snapshots) for d in range(3))
+            for c in range(len(snapshots[0]))]
+
+    UMean = internal_field(os.path.join(case, times[-1], "UMean"))
+
+    # UMean and the snapshots are written with 6 significant digits
+    scale = max(abs(v) for m in mean for v in m)
+    error = max(abs(u[d] - m[d]) for u, m in zip(UMean, mean) for d in range(3))
+
+    print("UMean of %d snapshots, max error %g of max velocity %g" % (len(times), error, scale))
+    return 0 if len(UMean) == len(mean) and error <= 1e-5*scale else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1]))
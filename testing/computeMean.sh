@@ -0,0 +1,17 @@
+#!/bin/sh
+# UMean of podBasisCalc -computeMean in memory, streamed and in single precision against..
+# ..the mean of the snapshots computed by compareMean.py
+#   computeMean.sh <podBasisCalc> <prepared case> <work dir> <python> <compareMean.py>
+set -e
+
+for opts in "" "-maxMemory 3" "-singlePrecision"
+do
+  echo "podBasisCalc -computeMean $opts"
+  rm -rf "$3"
+  cp -r "$2" "$3"
+  (
+    cd "$3"
+    "$1" 5 -computeMean $opts > log.podBasisCalc
+    "$4" "$5" .
+  )
+done
@@ -0,0 +1,12 @@
+#!/bin/sh
+# Runs a short SampleCase the tests share, 10 snapshots and the UMean of fieldAverage
+#   prepareSampleCase.sh <SampleCase> <case to create>
+set -e
+
+rm -rf "$2"
+cp -r "$1" "$2"
+cd "$2"
+
+foamDictionary -entry endTime -set 1.5 system/controlDict > /dev/null
+blockMesh > log.blockMesh
+pisoFoam > log.pisoFoam